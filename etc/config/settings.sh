@@ -162,6 +162,13 @@ export WM_DIR=$WM_PROJECT_DIR/wmake
 export WM_LINK_LANGUAGE=c++
 export WM_OPTIONS=$WM_ARCH$WM_COMPILER$WM_PRECISION_OPTION$WM_COMPILE_OPTION
 
+# the memory tracking changes the layout of the List storage, so the code
+# compiled with it is kept apart from the rest
+if [ "$WM_MEMORY_TRACKING" = on ]
+then
+    export WM_OPTIONS=${WM_OPTIONS}MemTrack
+fi
+
 # base executables/libraries
 export FOAM_APPBIN=$WM_PROJECT_DIR/platforms/$WM_OPTIONS/bin
 export FOAM_LIBBIN=$WM_PROJECT_DIR/platforms/$WM_OPTIONS/lib
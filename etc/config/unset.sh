@@ -59,6 +59,7 @@ unset WM_DIR
 unset WM_HOSTS
 unset WM_LDFLAGS
 unset WM_LINK_LANGUAGE
+unset WM_MEMORY_TRACKING
 unset WM_MPLIB
 unset WM_NCOMPPROCS
 unset WM_OPTIONS